@@ -0,0 +1,157 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdint.h>
+#include "index.h"
+
+
+// Compressed set of tuple positions, split into containers of 2^16
+// consecutive positions as in Roaring bitmaps. A container holding at
+// most BMARRAYMAX positions keeps their low 16 bits as a sorted
+// array, a fuller one is a plain bitset. AND and OR of two bitmaps
+// work container by container, without expanding the arrays.
+
+const int BMARRAYMAX = 4096;            // most positions of an array
+const int BMWORDS = 65536 / 64;         // 64-bit words of a bitset
+
+class Bitmap {
+ public:
+  Bitmap() : card(0) {}
+
+  void add(const unsigned pos);
+  void remove(const unsigned pos);
+  const bool contains(const unsigned pos) const;
+
+  const int count() const { return card; }
+  const bool empty() const { return card == 0; }
+
+  // this = this OR other, this = this AND other
+  void unionWith(const Bitmap & other);
+  void intersectWith(const Bitmap & other);
+
+  // positions in increasing order: start a cursor, then next()
+  // returns false when there are no more positions
+  typedef struct {
+    unsigned container;                 // current container
+    int next;                           // next array index or bit
+  } Cursor;
+  void start(Cursor & c) const { c.container = 0; c.next = 0; }
+  const bool next(Cursor & c, unsigned & pos) const;
+
+  // append the bitmap to out, or read one back from [p, end);
+  // load() returns false if the bytes are not a saved bitmap
+  void save(vector<char> & out) const;
+  const bool load(const char* & p, const char *end);
+
+ private:
+  typedef struct {
+    unsigned high;                      // positions >> 16
+    int card;                           // positions in the container
+    vector<unsigned short> array;       // low bits, if card <= BMARRAYMAX
+    vector<uint64_t> bits;              // bitset, if card > BMARRAYMAX
+  } Container;
+
+  vector<Container> containers;         // in order of high
+  int card;                             // positions in the bitmap
+
+  const int find(const unsigned high) const;
+  static void toBitset(Container & c);
+  static void toArray(Container & c);
+  static void normalize(Container & c);
+};
+
+
+// Header page of a bitmap index file. The distinct key values and
+// the bitmap of the tuple positions holding each are kept as one
+// byte stream in a chain of data pages. An open index holds them in
+// memory and writes them back when it is closed, if it was changed;
+// so only one open instance of an index may change it. Meant for
+// attributes with few distinct values, whose bitmaps are small.
+
+typedef struct {
+  int keyType;                          // Datatype of the keys
+  int keyLen;                           // length of a key in bytes
+  int valueCnt;                         // number of distinct keys
+  int entryCnt;                         // number of (key, RID) entries
+  int firstPage;                        // chain of data pages, -1 if none
+  int streamLen;                        // bytes in the chain
+} BitmapHdr;
+
+
+const int BMPAGEHDR = 2 * sizeof(int);
+
+typedef struct {
+  int nextPage;                         // next data page, -1 if none
+  int used;                             // bytes used on this page
+  char data[PAGESIZE - BMPAGEHDR];
+} BitmapPage;
+
+
+// A tuple's position in the bitmaps is its page number followed by
+// BMSLOTBITS bits of slot number; a 1K page has fewer slots than that
+
+const int BMSLOTBITS = 8;
+
+
+class BitmapIndex : public Index {
+ public:
+  // open the bitmap index in file fileName
+  BitmapIndex(const string & fileName, Status & status);
+  ~BitmapIndex();
+
+  // create an empty index file
+  static const Status create(const string & fileName,
+			     const Datatype type,
+			     const int keyLen);
+
+  const Status insertEntry(const char *key, const RID & rid);
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // scans visit the keys in range in key order, and the RIDs of
+  // each key in RID order
+  const Status startScan(const char *low, const bool lowIncl,
+			 const char *high, const bool highIncl);
+  using Index::scanNext;
+  const Status scanNext(RID & outRid, const char* & key);
+  const Status endScan();
+
+  // positions of the tuples whose key satisfies "key op value", for
+  // every operator including NE: the OR of the bitmaps of the keys
+  // that qualify
+  const Status matching(const Operator op, const char *value,
+			Bitmap & result) const;
+
+  static const unsigned position(const RID & rid)
+    { return ((unsigned)rid.pageNo << BMSLOTBITS) | rid.slotNo; }
+  static const RID ridAt(const unsigned pos)
+    { RID rid = { (int)(pos >> BMSLOTBITS),
+		  (int)(pos & ((1 << BMSLOTBITS) - 1)) };
+      return rid; }
+
+ private:
+  File*     file;                       // index file
+  int       headerPageNo;               // page number of header page
+  BitmapHdr* header;                    // header page, pinned while open
+  bool      dirty;                      // keys or bitmaps have changed
+  Datatype  keyType;
+  int       keyLen;
+  vector<char> keys;                    // distinct keys, in key order
+  vector<Bitmap> bitmaps;               // bitmap of each key
+
+  // state of the current scan
+  bool      scanning;
+  int       curValue;                   // key being scanned
+  int       endValue;                   // first key past the range
+  Bitmap::Cursor cursor;                // position within its bitmap
+
+  const char* keyAt(const int i) const { return &keys[i * keyLen]; }
+  const int compareKeys(const char *a, const char *b) const;
+
+  // first key >= key (> key if after)
+  const int lowerBound(const char *key, const bool after) const;
+
+  const Status readStream();
+  const Status writeStream();
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <stdint.h>
+#include <vector>
+using namespace std;
+
+#include "index.h"
+
+
+// A Bloom filter on the values of a join attribute. The build input
+// of a join enters its keys, and a scan of the other input drops the
+// tuples whose key the filter has not seen before they are
+// partitioned or sorted (see HeapFileScan::addBloomFilter()). Keys
+// are passed in their stored form, as in Index.
+//
+// The filter is blocked: a key sets BLOOMHASHES bits within one
+// block of 512 bits, so a test touches a single cache line. With
+// BLOOMBITSPERKEY bits per key about 1% of the absent keys pass.
+
+const int BLOOMBITSPERKEY = 10;
+const int BLOOMHASHES = 7;
+const int BLOOMBLOCKWORDS = 8;          // 64-bit words per block
+
+class BloomFilter {
+ public:
+  // a filter for about n keys of the given type and length
+  BloomFilter(const int n, const Datatype type, const int length);
+
+  void add(const char* key);            // enter a key
+  void merge(const BloomFilter & other);// enter the keys of a filter
+                                        // of the same size
+
+  // false if key was never entered; true for every entered key and
+  // for a few others
+  const bool mayContain(const char* key) const
+  {
+    const uint64_t h = hash(key);
+    const uint64_t* block = &bits[blockOf(h)];
+    unsigned pos = (unsigned)h, step = ((unsigned)h >> 9) | 1;
+    for (int i = 0; i < BLOOMHASHES; i++, pos += step)
+      if (!(block[(pos >> 6) & 7] & ((uint64_t)1 << (pos & 63))))
+	return false;
+    return true;
+  }
+
+  const Datatype keyType() const { return type; }
+  const int keyLength() const { return length; }
+
+ private:
+  // keyHash() of a key mixed into 64 bits
+  const uint64_t hash(const char* key) const
+  {
+    uint64_t h = keyHash(key, type, length);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  // first word of the block of a hash, picked by its high bits
+  const size_t blockOf(const uint64_t h) const
+  {
+    return (size_t)(((h >> 32) * blockCnt) >> 32) * BLOOMBLOCKWORDS;
+  }
+
+  Datatype type;                        // type of the keys
+  int length;                           // length of the keys
+  uint64_t blockCnt;                    // number of blocks
+  vector<uint64_t> bits;
+};
+
+#endif
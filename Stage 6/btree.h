@@ -0,0 +1,119 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include "index.h"
+
+
+// Default fill factor, in percent, of the nodes written by a bulk
+// load; the free space lets later inserts go in without splits
+const int BULKFILLFACTOR = 90;
+
+
+// Header page of a B+-tree index file.
+
+typedef struct {
+  int rootPage;                         // page number of the root node
+  int keyType;                          // Datatype of the keys
+  int keyLen;                           // length of a key in bytes
+  int height;                           // number of levels of the tree
+  int entryCnt;                         // number of (key, RID) entries
+} BTreeHdr;
+
+
+// A node of the tree occupies one page. Every entry is a (key, RID,
+// child) triple; the RID makes each entry unique, so duplicate
+// attribute values need no special handling. Leaves hold one entry
+// per tuple, the child field unused, and are chained in key order.
+// In an internal node child leads to the subtree of entries >= the
+// entry's (key, RID), and firstChild to entries below the first one.
+
+const int BTNODEHDR = 4 * sizeof(int);
+
+typedef struct {
+  int level;                            // 0 for leaves
+  int keyCnt;                           // number of entries
+  int nextLeaf;                         // next leaf, -1 for the last
+  int firstChild;                       // leftmost child (internal)
+  char entries[PAGESIZE - BTNODEHDR];
+} BTNode;
+
+
+class BTreeIndex : public Index {
+ public:
+  // open the B+-tree index in file fileName
+  BTreeIndex(const string & fileName, Status & status);
+  ~BTreeIndex();
+
+  // create an empty B+-tree index file
+  static const Status create(const string & fileName,
+			     const Datatype type,
+			     const int keyLen);
+
+  const Status insertEntry(const char *key, const RID & rid);
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  const Status startScan(const char *low, const bool lowIncl,
+			 const char *high, const bool highIncl);
+  using Index::scanNext;
+  const Status scanNext(RID & outRid, const char* & key);
+  const Status endScan();
+
+  // Bottom-up loading of an empty tree. Entries must be passed in
+  // key order; entries with equal keys may come in any order. Leaves
+  // are filled to fillFactor percent and written left to right, and
+  // endBulkLoad() builds the levels above them.
+  const Status startBulkLoad(const int fillFactor);
+  const Status bulkLoadEntry(const char *key, const RID & rid);
+  const Status endBulkLoad();
+
+ private:
+  File*     file;                       // index file
+  int       headerPageNo;               // page number of header page
+  BTreeHdr* header;                     // header page, pinned while open
+  bool      hdrDirty;                   // header page has been changed
+  Datatype  keyType;
+  int       keyLen;
+  int       entrySize;                  // bytes per entry
+  int       capacity;                   // max. entries per node
+
+  // state of the current scan
+  BTNode*   curNode;                    // pinned leaf, NULL if none
+  int       curPageNo;                  // page number of curNode
+  int       curEntry;                   // last entry returned
+  vector<char> lowKey, highKey;         // copies of the bounds
+  bool      hasLow, hasHigh;
+  bool      lowIncl, highIncl;
+
+  // state of a bulk load
+  BTNode*   bulkLeaf;                   // pinned leaf being filled
+  int       bulkLeafNo;                 // page number of bulkLeaf
+  int       bulkFill;                   // entries per node
+  vector<char> bulkSeps;                // first entry of each leaf
+  vector<char> bulkDups;                // pending entries with equal keys
+  int       bulkDupCnt;                 // number of pending entries
+
+  char* keyOf(BTNode *node, const int i) const
+    { return node->entries + i * entrySize; }
+  RID* ridOf(BTNode *node, const int i) const
+    { return (RID*)(node->entries + i * entrySize + keyLen); }
+  int* childOf(BTNode *node, const int i) const
+    { return (int*)(node->entries + i * entrySize + keyLen + sizeof(RID)); }
+
+  const int compareKeys(const char *a, const char *b) const;
+  const int compareEntry(const char *keyA, const RID & ridA,
+			 const char *keyB, const RID & ridB) const;
+
+  // number of entries of node that are <= (key, rid)
+  const int upperPos(BTNode *node, const char *key, const RID & rid) const;
+
+  const Status insert(const int pageNo, const char *key, const RID & rid,
+		      bool & split, char *upKey, RID & upRid, int & upChild);
+  const Status splitNode(BTNode *node, const int pos, const char *key,
+			 const RID & rid, const int child,
+			 char *upKey, RID & upRid, int & upChild);
+
+  // append the pending equal-key entries to the leaves in RID order
+  const Status flushBulkDups();
+};
+
+#endif
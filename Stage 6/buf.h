@@ -1,6 +1,8 @@
 #ifndef BUF_H
 #define BUF_H
 
+#include <mutex>
+#include <condition_variable>
 #include "db.h"
 // define if debug output wanted
 //#define DEBUGBUF
@@ -55,6 +57,7 @@ private:
   bool 	dirty;	  // true if dirty;  false otherwise
   bool 	valid;   // true if page is valid
   bool  refbit;	 // has this buffer frame been reference recently
+  bool  ioPending; // true while the page is being read into the frame
 
   void Clear() {  // initialize buffer frame for a new user
     	pinCnt = 0;
@@ -62,6 +65,7 @@ private:
 	pageNo = -1;
     	dirty = false;
 	valid = false;
+	ioPending = false;
   };
 
   void Set(File* filePtr, int pageNum) { 
@@ -71,6 +75,7 @@ private:
       dirty = false;
       valid = true;
       refbit = true;
+      ioPending = false;
   }
 
   BufDesc() {
@@ -106,6 +111,13 @@ private:
   BufDesc*	 bufTable;  	// vector of status info, 1 per page
   BufStats	 bufStats;	// buffer pool statistics
 
+  // The latch serializes all access to the buffer pool so that
+  // several scan threads can pin and unpin pages concurrently.
+  // Pages are read from disk without holding the latch; threads
+  // that want a page whose read is still in progress wait on ioDone.
+  std::mutex		 latch;
+  std::condition_variable ioDone;
+
   const Status allocBuf(int & frame);   // allocate a free frame.  
   const void releaseBuf(int frame); // return unused frame to end of list
   void advanceClock()
@@ -128,6 +140,10 @@ public:
   const Status disposePage(File* file, const int PageNo); // dispose of page in file
   void  printSelf();
 
+  // number of frames not pinned at the moment; operators that buffer
+  // data of their own size their memory by it
+  const int numUnpinned();
+
   const BufStats & getBufStats() const // get buffer pool usage
   {
 	return bufStats;
@@ -1,6 +1,7 @@
 #ifndef CATALOG_H
 #define CATALOG_H
 
+#include <unordered_map>
 #include "heapfile.h"
 
 
@@ -13,15 +14,23 @@
 #define MAXNAME      32                 // length of relName, attrName
 #define MAXSTRINGLEN 255                // max. length of string attribute
 
+// kinds of index, stored in AttrDesc.indexed
+#define NOTINDEXED   0                  // attribute is not indexed
+#define BTREEINDEX   1                  // B+-tree index
+#define HASHINDEX    2                  // linear hash index
+#define BITMAPINDEX  3                  // bitmap index
+
 
 // schema of relation catalog:
 //   relation name : char(32)           <-- lookup key
 //   attribute count : integer(4)
+//   index count : integer(4)
 
 
 typedef struct {
   char relName[MAXNAME];                // relation name
   int attrCnt;                          // number of attributes
+  int indexCnt;                         // number of indexed attributes
 } RelDesc;
 
 
@@ -48,6 +57,9 @@ class RelCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation);
 
+  // overwrite the catalog tuple of record.relName
+  const Status updateInfo(RelDesc & record);
+
   // create a new relation
   const Status createRel(const string & relation, 
 		   const int attrCnt, 
@@ -56,11 +68,37 @@ class RelCatalog : public HeapFile {
   // destroy a relation
   const Status destroyRel(const string & relation);
 
+  // build an index on an attribute of a relation; nbuckets is the
+  // initial number of buckets of a hash index
+  const Status addIndex(const string & relation, 
+			const string & attrName,
+			const int indexType,
+			const int nbuckets);
+
+  // replace the index on an attribute, if any, by a hash index
+  // with nbuckets initial buckets
+  const Status rebuildIndex(const string & relation, 
+			    const string & attrName,
+			    const int nbuckets);
+
+  // drop the index on an attribute, or all indexes of the relation
+  // if attrName is empty
+  const Status dropIndex(const string & relation, 
+			 const string & attrName);
+
   // print catalog information
   const Status help(const string & relation);          // relation may be NULL
 
   // get rid of catalog
   ~RelCatalog();
+
+ private:
+  // In-memory copy of the catalog keyed by relation name. It is read
+  // in on first use and kept current by addInfo() and removeInfo().
+  unordered_map<string, RelDesc> cache;
+  bool cacheLoaded;
+
+  const Status loadCache();
 };
 
 
@@ -70,6 +108,8 @@ class RelCatalog : public HeapFile {
 //   attribute number : integer(4)
 //   attribute type : integer(4)  (type is Datatype actually)
 //   attribute size : integer(4)
+//   index type : integer(4)  (NOTINDEXED, BTREEINDEX, HASHINDEX,
+//                                BITMAPINDEX)
 
 
 typedef struct {
@@ -78,6 +118,7 @@ typedef struct {
   int attrOffset;                       // attribute offset
   int attrType;                         // attribute type
   int attrLen;                          // attribute length
+  int indexed;                          // kind of index on attribute
 } AttrDesc;
 
 
@@ -99,23 +140,46 @@ class AttrCatalog : public HeapFile {
   // remove tuple from catalog
   const Status removeInfo(const string & relation, const string & attrName);
 
-  // get all attributes of a relation
+  // overwrite the catalog tuple of record.relName.record.attrName
+  const Status updateInfo(AttrDesc & record);
+
+  // get all attributes of a relation; attrs is malloc()ed and
+  // must be free()d by the caller
   const Status getRelInfo(const string & relation, 
 			  int &attrCnt, 
 			  AttrDesc *&attrs);
 
+  // get all attributes of a relation without copying them; attrs
+  // points into the catalog cache and is only valid until the
+  // catalog is next changed
+  const Status getRelInfo(const string & relation, 
+			  int &attrCnt, 
+			  const AttrDesc *&attrs);
+
   // delete all information about a relation
   const Status dropRelation(const string & relation);
 
   // close attribute catalog
   ~AttrCatalog();
+
+ private:
+  // In-memory copy of the catalog: the attributes of each relation
+  // in attrOffset order, and the same tuples keyed by (relation,
+  // attribute). Read in on first use and kept current by addInfo()
+  // and removeInfo().
+  unordered_map<string, vector<AttrDesc> > relAttrs;
+  unordered_map<string, AttrDesc> attrIndex;
+  bool cacheLoaded;
+
+  const Status loadCache();
+  void cacheInsert(const AttrDesc & record);
 };
 
 
 extern RelCatalog  *relCat;
 extern AttrCatalog *attrCat;
 extern Error error;
-extern Status createHeapFile(const string filename);
-extern Status destroyHeapFile(const string filename);
+extern const Status createHeapFile(const string filename);
+extern const Status destroyHeapFile(const string filename);
 
 #endif
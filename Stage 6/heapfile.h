@@ -24,6 +24,26 @@ const unsigned MAXNAMESIZE = 50;
 enum Datatype { STRING, INTEGER, FLOAT };    // attribute data types
 enum Operator { LT, LTE, EQ, GTE, GT, NE };  // scan operators
 
+class BloomFilter;
+
+// A scan predicate compiled by HeapFileScan::startScan(). The
+// (type, op) pair is resolved once into one of the specialized
+// match functions in heapfile.C, and INTEGER/FLOAT filter values
+// are decoded once, so matchRec() does no switching per record.
+
+struct ScanPredicate
+{
+  int		offset;		// byte offset of filter attribute
+  int		length;		// length of filter attribute
+  bool		(*test)(const ScanPredicate & pred, const char* attr);
+  union {
+    int		ival;		// decoded filter value of INTEGER predicate
+    float	fval;		// decoded filter value of FLOAT predicate
+  };
+  const char*	filter;		// comparison value of filter
+  const BloomFilter* bloom;	// filter of a Bloom filter predicate
+};
+
 struct FileHdrPage
 {
   char		fileName[MAXNAMESIZE];   // name of file
@@ -31,10 +51,31 @@ struct FileHdrPage
   int		lastPage;	// pageNo of last data page in file
   int		pageCnt;	// number of pages
   int		recCnt;		// record count
+  int		firstDirPage;	// pageNo of first page directory page
+  int		lastDirPage;	// pageNo of last page directory page
+};
+
+
+// The page directory of a heap file maps the logical index of each
+// data page (its position in the nextPage chain) to its physical
+// pageNo, so that page k can be reached without walking k pages.
+// It is kept in a chain of directory pages anchored in the header.
+
+const int DIRPAGESIZE = (PAGESIZE - 2 * sizeof(int)) / sizeof(int);
+
+struct DirPage
+{
+  int		nextDirPage;	// pageNo of next directory page, -1 if none
+  int		entryCnt;	// number of entries used on this page
+  int		pageNo[DIRPAGESIZE]; // pageNo of each data page in order
 };
 
 
 // class definition of heapFile
+// Called by HeapFile::getRecords() with the i-th requested record.
+// The record is only valid for the duration of the call.
+typedef const Status (*RecordFn)(const int i, const Record & rec, void* arg);
+
 class HeapFile {
 protected:
    File* 	filePtr;        // underlying DB File object
@@ -47,6 +88,14 @@ protected:
    bool  	curDirtyFlag;   // true if page has been updated
    RID   	curRec;         // rid of last record returned
 
+   vector<int>	pageDir;	// in-memory copy of the page directory
+
+   // append a newly linked data page to the page directory
+   const Status addDirEntry(const int pageNo);
+
+   // (re)read the page directory into pageDir
+   const Status loadPageDir();
+
 public:
 
   // initialize
@@ -58,8 +107,19 @@ public:
   // return number of records in file
   const int getRecCnt() const;
 
+  // return number of data pages in file
+  const int getPageCount() const;
+
+  // return pageNo of the i-th data page (0 <= i < getPageCount())
+  const Status getPageNo(const int i, int & pageNo);
+
   // given a RID, read record from file, returning pointer and length
   const Status getRecord(const RID &rid, Record & rec);
+
+  // fetch n records, pinning each page only once, and pass them
+  // to fn in the order of rids[]; stops at the first error
+  const Status getRecords(const RID* rids, const int n,
+			  const RecordFn fn, void* arg);
 };
 
 
@@ -78,6 +138,18 @@ public:
                            const char* filter, 
                            const Operator op);
 
+    // add another predicate to the scan; records must satisfy
+    // all predicates (conjunction) to be returned by scanNext
+    const Status addFilter(const int offset, 
+                           const int length,  
+                           const Datatype type, 
+                           const char* filter, 
+                           const Operator op);
+
+    // add the predicate that the attribute at offset may be one of
+    // the keys of bloom, which must outlive the scan
+    const Status addBloomFilter(const int offset, const BloomFilter & bloom);
+
     const Status endScan(); // terminate the scan
     const Status markScan(); // save current position of scan
     const Status resetScan(); // reset scan to last marked location
@@ -88,18 +160,30 @@ public:
     // read current record, returning pointer and length
     const Status getRecord(Record & rec);
 
+    // read an arbitrary record, as in HeapFile; it becomes the
+    // current record for deleteRecord() and updateRecord()
+    using HeapFile::getRecord;
+
+    // true if rec satisfies all of the scan's predicates
+    const bool matchRec(const Record & rec) const;
+
     // delete current record 
     const Status deleteRecord();
 
+    // overwrite current record in place with a record of the same length
+    const Status updateRecord(const Record & rec);
+
     // marks current page of scan dirty
     const Status markDirty();
 
+    // restrict the scan to count data pages starting with the
+    // first-th page of the file (0-based, in page directory order)
+    const Status setPageRange(const int first, const int count);
+
 private:
-    int   offset;            // byte offset of filter attribute
-    int   length;            // length of filter attribute
-    Datatype type;           // datatype of filter attribute
-    const char* filter;      // comparison value of filter
-    Operator op;             // comparison operator of filter
+    vector<ScanPredicate> preds; // conjunction of compiled predicates
+    int   predExtent;        // end of rightmost filter attribute
+    int   pagesLeft;         // pages left in a page range scan, -1 if none
 
      // The following variables are used to preserve the state
     // of the scan when the method markScan() is invoked.
@@ -107,8 +191,7 @@ private:
     // scan to be rolled back to the following
     int   markedPageNo;	// page number of pinned page
     RID   markedRec;         // rid of last record returned
-
-    const bool matchRec(const Record & rec) const;
+    int   markedPagesLeft;   // pagesLeft of a page range scan
 };
 
 
@@ -0,0 +1,114 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include <vector>
+#include <cstring>
+#include "catalog.h"
+
+
+// Interface shared by the secondary index structures. An index maps
+// attribute values to the RIDs of the tuples holding them. Keys are
+// passed in their stored form: attrLen bytes, strings null-padded.
+
+class Index {
+ public:
+  virtual ~Index() {}
+
+  // add/remove the entry (key, rid)
+  virtual const Status insertEntry(const char *key, const RID & rid) = 0;
+  virtual const Status deleteEntry(const char *key, const RID & rid) = 0;
+
+  // scan the entries with low <(=) key <(=) high in key order;
+  // a NULL bound leaves that end of the range open
+  virtual const Status startScan(const char *low, const bool lowIncl,
+				 const char *high, const bool highIncl) = 0;
+
+  // RID of next entry in range, NOMORERECS at the end
+  const Status scanNext(RID & outRid)
+    { const char* key; return scanNext(outRid, key); }
+
+  // same, also returning the key of the entry, which stays valid
+  // until the next call; lets covered queries skip the heap file
+  virtual const Status scanNext(RID & outRid, const char* & key) = 0;
+  virtual const Status endScan() = 0;
+};
+
+
+// Hash of a key in its stored form, for everything that hashes keys:
+// keys that compare equal hash alike, so strings are hashed up to
+// their terminating null and both zeros of a float hash as +0.0.
+// Integers and floats come back as their bits; callers mix the result
+// as their use needs.
+
+inline const unsigned keyHash(const char *key, const Datatype type,
+			      const int len)
+{
+  unsigned h;
+
+  switch (type) {
+  case INTEGER:
+    memcpy(&h, key, sizeof(int));
+    return h;
+  case FLOAT: {
+    float f;
+    memcpy(&f, key, sizeof(float));
+    if (f == 0) f = 0;
+    memcpy(&h, &f, sizeof(float));
+    return h;
+  }
+  default:
+    h = 2166136261u;
+    for (int i = 0; i < len && key[i]; i++)
+      h = (h ^ (unsigned char)key[i]) * 16777619u;
+    return h;
+  }
+}
+
+
+// name of the file holding the index on relation.attrName
+const string indexFileName(const string & relation, const string & attrName);
+
+// create, open and destroy the index described by attr.indexed;
+// nbuckets only applies to hash indexes
+const Status createIndex(const AttrDesc & attr, const int nbuckets);
+const Status openIndex(const AttrDesc & attr, Index* & index);
+const Status destroyIndex(const AttrDesc & attr);
+
+// true if the index on attr, if any, can answer "attr op value"
+// with a scan: B+-tree and bitmap indexes handle every operator but
+// NE, hash indexes only EQ
+const bool indexUsable(const AttrDesc & attr, const Operator op);
+
+// Translates "attr op value" into index scan bounds. Returns false
+// for NE, which an index cannot answer with a single range.
+const bool opBounds(const Operator op, const char *value,
+		    const char* & low, bool & lowIncl,
+		    const char* & high, bool & highIncl);
+
+
+// All indexes of one relation, opened together so inserts, deletes
+// and updates of tuples can keep every index current. Cheap to
+// construct for relations without indexes.
+
+class RelIndexes {
+ public:
+  RelIndexes(const string & relation, Status & status);
+  ~RelIndexes();
+
+  const bool empty() const { return indexes.empty(); }
+
+  // add/remove the entries of tuple rec stored at rid
+  const Status insertEntries(const Record & rec, const RID & rid);
+  const Status deleteEntries(const Record & rec, const RID & rid);
+
+  // move the entries of a tuple updated in place from oldRec's
+  // values to newRec's, for the indexed attributes that changed
+  const Status updateEntries(const Record & oldRec, const Record & newRec,
+			     const RID & rid);
+
+ private:
+  vector<AttrDesc> attrs;               // indexed attributes
+  vector<Index*> indexes;               // open index of each
+};
+
+#endif
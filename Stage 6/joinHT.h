@@ -1,40 +1,47 @@
+#ifndef JOINHT_H
+#define JOINHT_H
+
+#include <vector>
+#include "catalog.h"
+
+// In-memory hash table of the build tuples of a hash join. The tuples
+// are copied into one array of fixed-size entries, each holding the
+// number of the next entry on its chain, the full hash of its join
+// attribute as a tag, and the tuple itself; the directory holds the
+// first entry of each chain. A probe compares tags before keys and
+// passes the matching tuples straight out of the array, so neither
+// probes nor inserts allocate once the array has reached its size.
 
 class joinHashTbl
 {
-private:
-    union JAttrType
-    {
-	int iValue;
-	float fValue;
-	char* sValue;
-    };
-	
-    struct joinhashBucket
-    {
-	union JAttrType	attrValue;
-       	RID	rid;
-       	joinhashBucket*     next;    // next node in the hash table
-    };
+public:
+    // size is the expected number of tuples, tupleLen their length
+    joinHashTbl(const int size, const AttrDesc & attr, const int tupleLen);
 
-    struct HTentry
-    {
-	int bucketCnt;  // nuumber of buckets on this chain
-	joinhashBucket*   chain;  // pointer to first bucket on the chain
-    };
+    // copy tuple into the table
+    void insert(const char* tuple);
 
-    AttrDesc 	joinAttr;
-    int 	HTSIZE;
-    HTentry 	*ht; // actual hash table
-    int  hash(const char* attr, int attrType); // returns value between 0 and HTSIZE-1
+    // pass each tuple whose join attribute equals key to fn, numbered
+    // from 0; stops at the first error
+    const Status lookup(const char* key, const RecordFn fn, void* arg) const;
 
-public:
-    joinHashTbl(const int size, const AttrDesc attr);  // constructor
-    ~joinHashTbl();
+private:
+    struct Entry
+    {
+	int next;               // next entry on the chain, -1 at the end
+	unsigned tag;           // hash of the join attribute
+    };                          // followed by the tuple
 
-     // insert a new (JoinAttrValue, RID) pair into hash table
-     Status insert(const RID newRid,  const char* tuple);
+    unsigned hash(const char* key) const;
+    bool equal(const char* key1, const char* key2) const;
 
-     // get RIDs of records whose join attribute value matches innerJoinAttrValue
-     Status lookup(const char* innerJoinAttrPtr, int & ridCount, RID *&outRids);
+    AttrDesc joinAttr;
+    int tupleLen;
+    int stride;                 // bytes per entry
+    int shift;                  // 32 - log2 of the directory size
+    int entryCnt;
+    vector<int> heads;          // first entry of each chain, -1 if none
+    vector<char> entries;
 };
 
+#endif
@@ -0,0 +1,60 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include "catalog.h"
+
+
+// TupleLayout is a projection compiled from the AttrDesc's of the
+// projected attributes. Attributes that are adjacent in both the
+// source and the result tuple are merged into a single run, so that
+// projecting a tuple is one memcpy per run rather than one per
+// attribute. An operator builds its layout once per query and then
+// uses it for every tuple it produces.
+
+class TupleLayout {
+ public:
+  // projection of tuples of a single relation
+  TupleLayout(const int projCnt, const AttrDesc projDescs[]);
+
+  // projection of pairs of tuples (as produced by a join): attributes
+  // of relation rel1 come from the first tuple, all others from the
+  // second
+  TupleLayout(const int projCnt, const AttrDesc projDescs[],
+	      const string & rel1);
+
+  // length of a result tuple
+  const int length() const { return width; }
+
+  // build a result tuple from a source tuple
+  void project(const char *src, char *dst) const
+  {
+    for (int i = 0; i < runCnt; i++)
+      memcpy(dst + runs[i].dstOffset, src + runs[i].srcOffset,
+	     runs[i].length);
+  }
+
+  // build a result tuple from a pair of source tuples
+  void project(const char *src1, const char *src2, char *dst) const
+  {
+    for (int i = 0; i < runCnt; i++)
+      memcpy(dst + runs[i].dstOffset,
+	     (runs[i].source == 0 ? src1 : src2) + runs[i].srcOffset,
+	     runs[i].length);
+  }
+
+ private:
+  typedef struct {
+    int source;                         // 0 = first tuple, 1 = second
+    int srcOffset;                      // offset in source tuple
+    int dstOffset;                      // offset in result tuple
+    int length;                         // bytes to copy
+  } CopyRun;
+
+  vector<CopyRun> runs;                 // merged copy runs
+  int runCnt;                           // runs.size(), for the copy loops
+  int width;                            // length of result tuple
+
+  void addAttr(const int source, const AttrDesc & attr);
+};
+
+#endif
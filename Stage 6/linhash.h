@@ -0,0 +1,108 @@
+#ifndef LINHASH_H
+#define LINHASH_H
+
+#include "index.h"
+
+
+// Header page of a linear hash index file. The index starts with
+// initBuckets buckets and splits one bucket at a time, in order,
+// whenever the average bucket grows too full: bucket next is split
+// into next and next + (initBuckets << level), and after the last
+// bucket of a round has been split the level goes up by one.
+
+typedef struct {
+  int keyType;                          // Datatype of the keys
+  int keyLen;                           // length of a key in bytes
+  int initBuckets;                      // number of buckets at level 0
+  int level;                            // current round of splitting
+  int next;                             // next bucket to be split
+  int bucketCnt;                        // number of buckets
+  int entryCnt;                         // number of (key, RID) entries
+  int firstDirPage;                     // chain of directory pages
+  int lastDirPage;
+} HashHdr;
+
+
+// Directory page: page numbers of the primary pages of the buckets,
+// in bucket order. The whole directory is read into memory when the
+// index is opened; it only grows, by one bucket per split.
+
+const int HASHDIRSIZE = (PAGESIZE - 2 * sizeof(int)) / sizeof(int);
+
+typedef struct {
+  int nextPage;                         // next directory page, -1 if none
+  int bucketCnt;                        // entries used on this page
+  int bucketPages[HASHDIRSIZE];
+} HashDirPage;
+
+
+// Bucket page, either the primary page of a bucket or an overflow
+// page chained behind it. Entries are (key, RID) pairs in no order.
+
+const int HASHPAGEHDR = 2 * sizeof(int);
+
+typedef struct {
+  int nextPage;                         // next overflow page, -1 if none
+  int entryCnt;                         // number of entries
+  char entries[PAGESIZE - HASHPAGEHDR];
+} HashPage;
+
+
+class LinearHashIndex : public Index {
+ public:
+  // open the linear hash index in file fileName
+  LinearHashIndex(const string & fileName, Status & status);
+  ~LinearHashIndex();
+
+  // create an empty index file with nbuckets buckets
+  static const Status create(const string & fileName,
+			     const Datatype type,
+			     const int keyLen,
+			     const int nbuckets);
+
+  const Status insertEntry(const char *key, const RID & rid);
+  const Status deleteEntry(const char *key, const RID & rid);
+
+  // only equality scans (low == high, both inclusive) are supported
+  const Status startScan(const char *low, const bool lowIncl,
+			 const char *high, const bool highIncl);
+  using Index::scanNext;
+  const Status scanNext(RID & outRid, const char* & key);
+  const Status endScan();
+
+ private:
+  File*     file;                       // index file
+  int       headerPageNo;               // page number of header page
+  HashHdr*  header;                     // header page, pinned while open
+  bool      hdrDirty;                   // header page has been changed
+  Datatype  keyType;
+  int       keyLen;
+  int       entrySize;                  // bytes per entry
+  int       capacity;                   // max. entries per page
+  vector<int> buckets;                  // primary page of each bucket
+
+  // state of the current scan
+  HashPage* curPage;                    // pinned bucket page, NULL if none
+  int       curPageNo;                  // page number of curPage
+  int       curEntry;                   // last entry examined
+  vector<char> scanKey;                 // copy of the search key
+
+  char* keyOf(HashPage *page, const int i) const
+    { return page->entries + i * entrySize; }
+  RID* ridOf(HashPage *page, const int i) const
+    { return (RID*)(page->entries + i * entrySize + keyLen); }
+
+  const unsigned hashKey(const char *key) const;
+  const bool equalKeys(const char *a, const char *b) const;
+  const int bucketOf(const char *key) const;
+
+  // add an entry to the chain whose last page is pinned as tail,
+  // allocating an overflow page when the tail is full
+  const Status append(HashPage* & tail, int & tailNo,
+		      const char *entry);
+
+  const Status addBucket(const int pageNo);
+  const Status splitBucket();
+};
+
+#endif
@@ -59,6 +59,10 @@ public:
     // delete the record with the specified rid
     const Status deleteRecord(const RID & rid);
 
+    // overwrite the record with the specified rid in place; the
+    // new record must have the same length as the old one
+    const Status updateRecord(const RID & rid, const Record & rec);
+
     // returns RID of first record on page
     // returns  NORECORDS if page contains no records.  Otherwise, returns OK
     const Status firstRecord(RID& firstRid) const;
@@ -49,6 +49,7 @@ typedef enum {
     N_QUERY,
     N_INSERT,
     N_DELETE,
+    N_UPDATE,
     N_CREATE,
     N_DESTROY,
     N_BUILD,
@@ -65,7 +66,8 @@ typedef enum {
     N_ATTRTYPE,
     N_VALUE,
     N_LIST,
-    N_ALIAS
+    N_ALIAS,
+    N_ORDER
 } NODEKIND;
 
 
@@ -82,6 +84,7 @@ typedef struct node {
 	    char *relname;
 	    struct node *attrlist;
 	    struct node *qual;
+	    struct node *order;
 	} QUERY;
 
 	// insert node */
@@ -96,6 +99,13 @@ typedef struct node {
 	    struct node *qual;
 	} DELETE;
 
+	// update node */
+	struct {
+	    char *relname;
+	    struct node *attrlist;
+	    struct node *qual;
+	} UPDATE;
+
 	// create node */
 	struct {
 	    char *relname;
@@ -113,6 +123,7 @@ typedef struct node {
 	    char *relname;
 	    char *attrname;
 	    int nbuckets;
+	    int bitmap;
 	} BUILD;
 
 	// drop node */
@@ -203,6 +214,13 @@ typedef struct node {
 	  char *relname;
 	  char *alias;
 	} ALIAS;
+
+	// order by node */
+	struct {
+	    struct node *attr;
+	    int desc;
+	    int limit;                  // -1 if no limit
+	} ORDER;
     } u;
 } NODE;
 
@@ -212,12 +230,13 @@ typedef struct node {
 //
 
 NODE *newnode(int kind);
-NODE *query_node(char *relname, NODE *attrlist, NODE *n);
+NODE *query_node(char *relname, NODE *attrlist, NODE *n, NODE *order);
 NODE *insert_node(char *relname, NODE *attrlist);
 NODE *delete_node(char *relname, NODE *qual);
+NODE *update_node(char *relname, NODE *attrlist, NODE *qual);
 NODE *create_node(char *relname, NODE *attrlist, NODE *primattr);
 NODE *destroy_node(char *relname);
-NODE *build_node(char *relname, char *attrname, int nbuckets);
+NODE *build_node(char *relname, char *attrname, int nbuckets, int bitmap);
 NODE *rebuild_node(char *relname, char *attrname, int nbuckets);
 NODE *drop_node(char *relname, char *attrname);
 NODE *load_node(char *relname, char *filename);
@@ -237,6 +256,7 @@ NODE *list_node(NODE *n);
 NODE *prepend(NODE *n, NODE *list);
 NODE *merge_attr_value_list(NODE *attr_list, NODE *value_list);
 NODE *alias_node(char *relname, char *alias);
+NODE *order_node(NODE *attr, int desc, int limit);
 NODE *replace_alias_in_qualattr_list(NODE *alias, NODE *qualattr_list);
 NODE *replace_alias_in_condition(NODE *alias, NODE *where);
 #endif
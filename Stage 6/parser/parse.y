@@ -14,7 +14,7 @@ extern int yywrap();
 extern void reset_scanner();
 extern void quit();
 
-void yyerror(char *);
+void yyerror(const char *);
 
 extern char *yytext;                    // tokens in string format
 static NODE *parse_tree;                // root of parse tree
@@ -41,8 +41,16 @@ static NODE *parse_tree;                // root of parse tree
 		RW_WHERE
 		RW_INSERT
 		RW_DELETE
+		RW_UPDATE
+		RW_SET
 		RW_PRIMARY
 		RW_NUMBUCKETS
+		RW_BITMAP
+		RW_ORDER
+		RW_BY
+		RW_ASC
+		RW_DESC
+		RW_LIMIT
 		RW_ALL
 		RW_FROM
 		RW_AS
@@ -73,6 +81,8 @@ static NODE *parse_tree;                // root of parse tree
 		T_SHELL_CMD
 
 %type	<ival>	op
+		opt_desc
+		opt_limit
 
 %type	<sval>	opt_into_relname
 		opt_relname
@@ -82,12 +92,11 @@ static NODE *parse_tree;                // root of parse tree
 		query
 		insert
 		delete
+		update
 		create
 		destroy
 		build
-/*
 		rebuild
-*/
 		drop
 		load
 		print
@@ -95,15 +104,15 @@ static NODE *parse_tree;                // root of parse tree
 		quit
 		opt_primary_attr
 		opt_where
+		opt_order
 		qual
+		conjunction
 		selection
 		join
 		non_mt_qualattr_list
 		qualattr
-/*
 		non_mt_attrval_list
 		attrval
-*/
 		non_mt_attrtype_list
 		attrtype
 		value
@@ -145,12 +154,11 @@ command
 	: query
 	| insert
 	| delete
+	| update
 	| create
 	| destroy
 	| build
-/*
 	| rebuild
-*/
 	| drop
 	| load
 	| print
@@ -163,7 +171,7 @@ command
 	;
 
 query
-	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where
+	: RW_SELECT non_mt_qualattr_list opt_into_relname RW_FROM table_list opt_where opt_order
 /*	RW_SELECT opt_into_relname '(' non_mt_qualattr_list ')' opt_where */
 	{
 		NODE *where;
@@ -171,13 +179,17 @@ query
 		if (qualattr_list == NULL) { // something wrong in qualattr_list
 		  $$ = NULL;
 		}
+		else if ($7 != NULL &&
+			 replace_alias_in_qualattr_list($5, list_node($7->u.ORDER.attr)) == NULL) {
+		  $$ = NULL; // something wrong in order by attribute
+		}
 		else {
 		  where = replace_alias_in_condition($5, $6);
 		  if ((where == NULL) && ($6 != NULL)) {
 		     $$ = NULL; //something wrong in where condition
 		  }
 		  else {
-		    $$ = query_node($3, qualattr_list, where);
+		    $$ = query_node($3, qualattr_list, where, $7);
 		  }
 		}
 	}
@@ -255,6 +267,19 @@ delete
 	}
 	;
 
+update
+	: RW_UPDATE string RW_SET non_mt_attrval_list opt_where
+	{
+		NODE *where = replace_alias_in_condition(list_node(alias_node($2, NULL)), $5);
+		if ((where == NULL) && ($5 != NULL)) {
+		  $$ = NULL; //something wrong in where condition
+		}
+		else {
+		  $$ = update_node($2, $4, where);
+		}
+	}
+	;
+
 create
 	: RW_CREATE RW_TABLE string '(' non_mt_attrtype_list ')' opt_primary_attr
 	{
@@ -272,18 +297,24 @@ destroy
 build
 	: RW_BUILD string '(' string ')'
 	{
-		$$ = build_node($2, $4, 0);
+		$$ = build_node($2, $4, 0, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
+	{
+		$$ = build_node($2, $4, $8, 0);
+	}
+	| RW_BUILD string '(' string ')' RW_BITMAP
+	{
+		$$ = build_node($2, $4, 0, 1);
 	}
 	;
 
-/*
 rebuild
 	: RW_REBUILD string '(' string ')' RW_NUMBUCKETS T_EQ T_INT
 	{
 		$$ = rebuild_node($2, $4, $8);
 	}
 	;
-*/
 
 drop
 	: RW_DROP string '(' string ')'
@@ -367,9 +398,65 @@ opt_where
 	}
 	;
 
+opt_order
+	: RW_ORDER RW_BY qualattr opt_desc opt_limit
+	{
+		$$ = order_node($3, $4, $5);
+	}
+	| nothing
+	{
+		$$ = NULL;
+	}
+	;
+
+opt_desc
+	: RW_ASC
+	{
+		$$ = 0;
+	}
+	| RW_DESC
+	{
+		$$ = 1;
+	}
+	| nothing
+	{
+		$$ = 0;
+	}
+	;
+
+opt_limit
+	: RW_LIMIT T_INT
+	{
+		if ($2 < 0) {
+			yyerror("negative limit");
+			YYERROR;
+		}
+		$$ = $2;
+	}
+	| nothing
+	{
+		$$ = -1;
+	}
+	;
+
 qual
 	: selection
 	| join
+	| selection RW_AND conjunction
+	{
+		$$ = prepend($1, $3);
+	}
+	;
+
+conjunction
+	: selection RW_AND conjunction
+	{
+		$$ = prepend($1, $3);
+	}
+	| selection
+	{
+		$$ = list_node($1);
+	}
 	;
 
 selection
@@ -411,7 +498,6 @@ qualattr
 		$$ = qualattr_node(NULL, $1);
 	}
 	;
-/*
 non_mt_attrval_list
 	: attrval ',' non_mt_attrval_list
 	{
@@ -429,7 +515,6 @@ attrval
 		$$ = attrval_node($1, $3);
 	}
 	;
-*/
 non_mt_attrtype_list
 	: attrtype ',' non_mt_attrtype_list
 	{
@@ -536,7 +621,7 @@ void parse(void)
 }
 
 
-void yyerror(char *s)
+void yyerror(const char *s)
 {
   puts(s);
 }
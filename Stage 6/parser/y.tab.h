@@ -68,32 +68,40 @@ extern int yydebug;
     RW_WHERE = 269,                /* RW_WHERE  */
     RW_INSERT = 270,               /* RW_INSERT  */
     RW_DELETE = 271,               /* RW_DELETE  */
-    RW_PRIMARY = 272,              /* RW_PRIMARY  */
-    RW_NUMBUCKETS = 273,           /* RW_NUMBUCKETS  */
-    RW_ALL = 274,                  /* RW_ALL  */
-    RW_FROM = 275,                 /* RW_FROM  */
-    RW_AS = 276,                   /* RW_AS  */
-    RW_TABLE = 277,                /* RW_TABLE  */
-    RW_AND = 278,                  /* RW_AND  */
-    RW_OR = 279,                   /* RW_OR  */
-    RW_NOT = 280,                  /* RW_NOT  */
-    RW_VALUES = 281,               /* RW_VALUES  */
-    INT_TYPE = 282,                /* INT_TYPE  */
-    REAL_TYPE = 283,               /* REAL_TYPE  */
-    CHAR_TYPE = 284,               /* CHAR_TYPE  */
-    T_EQ = 285,                    /* T_EQ  */
-    T_LT = 286,                    /* T_LT  */
-    T_LE = 287,                    /* T_LE  */
-    T_GT = 288,                    /* T_GT  */
-    T_GE = 289,                    /* T_GE  */
-    T_NE = 290,                    /* T_NE  */
-    T_EOF = 291,                   /* T_EOF  */
-    NOTOKEN = 292,                 /* NOTOKEN  */
-    T_INT = 293,                   /* T_INT  */
-    T_REAL = 294,                  /* T_REAL  */
-    T_STRING = 295,                /* T_STRING  */
-    T_QSTRING = 296,               /* T_QSTRING  */
-    T_SHELL_CMD = 297              /* T_SHELL_CMD  */
+    RW_UPDATE = 272,               /* RW_UPDATE  */
+    RW_SET = 273,                  /* RW_SET  */
+    RW_PRIMARY = 274,              /* RW_PRIMARY  */
+    RW_NUMBUCKETS = 275,           /* RW_NUMBUCKETS  */
+    RW_BITMAP = 276,               /* RW_BITMAP  */
+    RW_ORDER = 277,                /* RW_ORDER  */
+    RW_BY = 278,                   /* RW_BY  */
+    RW_ASC = 279,                  /* RW_ASC  */
+    RW_DESC = 280,                 /* RW_DESC  */
+    RW_LIMIT = 281,                /* RW_LIMIT  */
+    RW_ALL = 282,                  /* RW_ALL  */
+    RW_FROM = 283,                 /* RW_FROM  */
+    RW_AS = 284,                   /* RW_AS  */
+    RW_TABLE = 285,                /* RW_TABLE  */
+    RW_AND = 286,                  /* RW_AND  */
+    RW_OR = 287,                   /* RW_OR  */
+    RW_NOT = 288,                  /* RW_NOT  */
+    RW_VALUES = 289,               /* RW_VALUES  */
+    INT_TYPE = 290,                /* INT_TYPE  */
+    REAL_TYPE = 291,               /* REAL_TYPE  */
+    CHAR_TYPE = 292,               /* CHAR_TYPE  */
+    T_EQ = 293,                    /* T_EQ  */
+    T_LT = 294,                    /* T_LT  */
+    T_LE = 295,                    /* T_LE  */
+    T_GT = 296,                    /* T_GT  */
+    T_GE = 297,                    /* T_GE  */
+    T_NE = 298,                    /* T_NE  */
+    T_EOF = 299,                   /* T_EOF  */
+    NOTOKEN = 300,                 /* NOTOKEN  */
+    T_INT = 301,                   /* T_INT  */
+    T_REAL = 302,                  /* T_REAL  */
+    T_STRING = 303,                /* T_STRING  */
+    T_QSTRING = 304,               /* T_QSTRING  */
+    T_SHELL_CMD = 305              /* T_SHELL_CMD  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
@@ -116,32 +124,40 @@ extern int yydebug;
 #define RW_WHERE 269
 #define RW_INSERT 270
 #define RW_DELETE 271
-#define RW_PRIMARY 272
-#define RW_NUMBUCKETS 273
-#define RW_ALL 274
-#define RW_FROM 275
-#define RW_AS 276
-#define RW_TABLE 277
-#define RW_AND 278
-#define RW_OR 279
-#define RW_NOT 280
-#define RW_VALUES 281
-#define INT_TYPE 282
-#define REAL_TYPE 283
-#define CHAR_TYPE 284
-#define T_EQ 285
-#define T_LT 286
-#define T_LE 287
-#define T_GT 288
-#define T_GE 289
-#define T_NE 290
-#define T_EOF 291
-#define NOTOKEN 292
-#define T_INT 293
-#define T_REAL 294
-#define T_STRING 295
-#define T_QSTRING 296
-#define T_SHELL_CMD 297
+#define RW_UPDATE 272
+#define RW_SET 273
+#define RW_PRIMARY 274
+#define RW_NUMBUCKETS 275
+#define RW_BITMAP 276
+#define RW_ORDER 277
+#define RW_BY 278
+#define RW_ASC 279
+#define RW_DESC 280
+#define RW_LIMIT 281
+#define RW_ALL 282
+#define RW_FROM 283
+#define RW_AS 284
+#define RW_TABLE 285
+#define RW_AND 286
+#define RW_OR 287
+#define RW_NOT 288
+#define RW_VALUES 289
+#define INT_TYPE 290
+#define REAL_TYPE 291
+#define CHAR_TYPE 292
+#define T_EQ 293
+#define T_LT 294
+#define T_LE 295
+#define T_GT 296
+#define T_GE 297
+#define T_NE 298
+#define T_EOF 299
+#define NOTOKEN 300
+#define T_INT 301
+#define T_REAL 302
+#define T_STRING 303
+#define T_QSTRING 304
+#define T_SHELL_CMD 305
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -154,7 +170,7 @@ union YYSTYPE
   char *sval;
   NODE *n;
 
-#line 158 "y.tab.h"
+#line 174 "y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
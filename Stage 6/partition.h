@@ -14,10 +14,16 @@ class Partition {
 	    const string & fileName,             // (base) name of heap file
 	    const int P,                      // number of partitions
 	    const int (*hashfcn)(const Record & rec,
-				 const int P),  
+				 const int P,
+				 void *arg),  
 	                               // hash function to use in partitioning
+	    void *hashArg,                // passed to hashfcn
 	    string* &partName,           // names of partitioned heap files
-	    Status &status);            // create partitions of file
+	    Status &status,             // create partitions of file
+	    const Status (*keep)(const Record & rec,
+				 void *arg) = NULL,
+	                               // takes partition 0 instead of its file
+	    void *keepArg = NULL);        // passed to keep
   ~Partition();                         // destroy partitions
 
  private:
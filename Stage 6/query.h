@@ -3,7 +3,7 @@
 
 #include "heapfile.h"
 
-enum JoinType {NLJoin, SMJoin, HashJoin};
+enum JoinType {NLJoin, SMJoin, HashJoin, HybridHashJoin};
 
 //
 // Prototypes for query layer functions
@@ -17,6 +17,15 @@ const Status QU_Select(const string & result,
 		       const Operator op, 
 		       const char *attrValue);
 
+// selection with a conjunction of condCnt predicates; the value of
+// conds[i] is passed (in string form) in conds[i].attrValue
+const Status QU_Select(const string & result, 
+		       const int projCnt, 
+		       const attrInfo projNames[],
+		       const int condCnt, 
+		       const attrInfo conds[], 
+		       const Operator ops[]);
+
 const Status QU_Join(const string & result, 
 		     const int projCnt, 
 		     const attrInfo projNames[],
@@ -34,4 +43,24 @@ const Status QU_Delete(const string & relation,
 		       const Datatype type, 
 		       const char *attrValue);
 
+// update the tuples of relation that satisfy the conjunction of
+// condCnt conditions, setting setAttrs[i] to its attrValue (in
+// string form, as are the condition values)
+const Status QU_Update(const string & relation, 
+		       const int setCnt, 
+		       const attrInfo setAttrs[],
+		       const int condCnt, 
+		       const attrInfo conds[], 
+		       const Operator ops[]);
+
+// write the first projCnt attributes of the tuples of relation source
+// to relation result in the order of attr, descending if descending
+// is set, keeping only the first limit of them unless limit is negative
+const Status QU_OrderBy(const string & source, 
+			const string & result, 
+			const int projCnt,
+			const attrInfo *attr, 
+			const bool descending, 
+			const int limit);
+
 #endif
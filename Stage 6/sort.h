@@ -1,30 +1,91 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <stdint.h>
+#include <mutex>
 #include "heapfile.h"
+#include "bloom.h"
 
 // define if debug output wanted
 //#define DEBUGSORT
 
 
-// SORTREC is an in-memory sort record that qsort(3) sorts.
-// The sort attribute as well as the associated RID are
-// stored in the record. The RID is used for fetching the
-// full record when it is needed.
+// SORTREC is an in-memory sort record of the run generation.
+// The record itself is copied to the tuple arena when the source
+// is scanned, so that runs are written from memory. The sort
+// attribute is also stored as an order-preserving prefix: prefixes
+// compare as unsigned numbers the way the attributes compare.
+// Integer and float attributes fit in the prefix whole; a string
+// keeps eight bytes there and is compared in the arena on ties.
 
 typedef struct {
-  RID rid;                              // record id of current record
-  char* field;                          // pointer to field
-  int length;                           // length of field
+  uint64_t prefix;                      // order-preserving key prefix
+  size_t at;                            // offset of record in the arena
+  int length;                           // length of record
 } SORTREC;
 
 
+// HEAPREC is a whole record held in memory by replacement selection,
+// together with the run it will be written to.
+
+typedef struct {
+  int run;                              // number of its run
+  vector<char> data;                    // copy of the record
+} HEAPREC;
+
+
+// How SortedFile forms its sorted runs. QSORTRUNS fills the buffer
+// with maxItems records, sorts them in memory and writes them out,
+// so every run is as long as the buffer.
+// REPLSELRUNS keeps maxItems whole records in a heap and writes them
+// by replacement selection: runs average twice the buffer on random
+// input, and input that is already sorted becomes a single run.
+
+enum RunGeneration { QSORTRUNS, REPLSELRUNS };
+
+
+// Direction of the sort on the attribute.
+
+enum SortOrder { ASCENDING, DESCENDING };
+
+
+// Each run being merged keeps its header page and current data page
+// pinned. Unless the caller sets a fan-in, SortedFile merges as many
+// runs at once as the unpinned buffer frames allow after keeping
+// SORTRESERVEPAGES for the file a merge pass writes and for the
+// caller. If there are more runs, groups of them are first merged
+// into longer runs, until one merge can take them all.
+
+const int SORTRUNPAGES = 2;
+const int SORTRESERVEPAGES = 4;
+
+
+// With several threads, SortedFile splits the source into page
+// ranges and generates runs from each range in its own thread, with
+// its share of maxItems. The final merge is split into key ranges,
+// bounded by splitters sampled from the first keys of the run pages;
+// each range is merged in its own thread into a run of its own, and
+// those runs, being disjoint, are read one after the other. A thread
+// gets at least PARALLELSORTPAGES pages, and there are at most
+// MAXSORTTHREADS.
+
+const int PARALLELSORTPAGES = 64;
+const int MAXSORTTHREADS = 8;
+
+
 class SortedFile {
  public:
   SortedFile(const string & fileName, 
 	     int offset,// sort source file on the given
 	     int length, Datatype type, // attribute
-	     int maxItems, Status& status);
+	     int maxItems, Status& status,
+	     RunGeneration runGen = QSORTRUNS,
+	     int maxFanIn = 0,          // runs merged at once, 0 = auto
+	     int threads = 1,           // threads that sort and merge
+	     SortOrder order = ASCENDING,
+	     const BloomFilter* filter = NULL,
+					// sort only records whose key it has
+	     BloomFilter* keys = NULL); // enter the keys of the source
 
   Status next(Record & rec);            // fetch next record in sort order
   Status setMark();                     // record a position in sort sequence
@@ -32,10 +93,6 @@ class SortedFile {
   ~SortedFile();                        // destroy temporary structures / files
 
  private:
-  Status sortFile();                    // split source file into sub-runs
-  Status generateRun(int numItems);     // generate one sub-run of file
-  Status startScans();                  // start a scan on each sorted run
-
   typedef struct {
     string name;                        // name of run file
     HeapFileScan* inFile;               // ptr to input file
@@ -44,20 +101,85 @@ class SortedFile {
     Record rec;
     RID rid;                            // RID of current record of run
     RID mark;
+    int lastPage;                       // page of last record written
+    vector<char> firstKeys;             // sort attribute of the first
+                                        // record of each page
   } RUN;
 
+  // Memory of one thread generating runs: the sort buffer, a second
+  // buffer for radix sorting and the tuple arena with the records.
+  typedef struct {
+    SORTREC* buffer;                    // in-memory sort buffer
+    SORTREC* spare;                     // second buffer for radix sort
+    vector<char> tuples;                // records of buffer
+  } SORTAREA;
+
+  Status sortFile();                    // split source file into sub-runs
+  Status generateRuns(HeapFileScan* scan, int items, BloomFilter* keys);
+                                        // runs of one scan, items at a time
+  Status generateRun(SORTAREA & area, int items);
+                                        // generate one sub-run of file
+  void sortBuffer(SORTAREA & area, int items);
+                                        // sort area.buffer[0..items)
+  Status replacementRuns(HeapFileScan* scan, int items,
+			 BloomFilter* keys);
+                                        // generate the sub-runs of a scan
+                                        // by replacement selection
+  const bool before(const HEAPREC & a, const HEAPREC & b) const;
+  void siftDown(const vector<HEAPREC> & recs, vector<int> & heap,
+		const int n, int i) const;
+
   vector<RUN> runs;                   // holds info about each sub-run
+  int runCnt;                           // runs created
+  int fanIn;                            // most runs merged at once
+  int threads;                          // most threads to sort with
+
+  // Threads generating runs share runs and runCnt, and open and
+  // close files, under this latch.
+  mutex runLatch;
+
+  Status openRun(RUN & run);            // create a run, open for inserts
+  Status closeRun(RUN & run);           // close a run written to
+  void addRun(const RUN & run);         // add a finished run to runs
+  Status appendRecord(RUN & run, const Record & rec);
+                                        // write a record to a run
+  Status mergePass(int count);          // merge first count runs into one
+  Status mergeRuns(vector<RUN> & in, RUN & out);
+                                        // merge scans in into run out
+  Status partitionMerge(int parts);     // merge key ranges in parallel
+  Status startScans(vector<RUN> & in);  // start a scan on each sorted run
+
+  // Loser tree over the runs for the merge: tree[0] is the run with
+  // the smallest next record, tree[1..k-1] hold the losers of the
+  // matches played at the inner nodes. Leaf i sits at node k + i.
+  // After a run advances only the matches on its path are replayed,
+  // so a record costs log k key comparisons. Merge passes keep trees
+  // of their own over the runs they merge.
+  vector<int> tree;
+  bool treeValid;                       // false after gotoMark()
+
+  Status fetch(RUN & run);              // read next record of a run
+  const bool beats(const vector<RUN> & in, const int a, const int b) const;
+  void buildTree(const vector<RUN> & in, vector<int> & t) const;
+                                        // play every match
+  void replay(const vector<RUN> & in, vector<int> & t, const int i) const;
+                                        // replay the path of run i
+  Status nextOf(vector<RUN> & in, vector<int> & t, bool & tValid,
+		Record & rec);          // next record of a merge
+
+  // comparison of two sort keys, chosen for the key type
+  int (*keycmp)(const char* p1, const char* p2, int len);
 
-  HeapFile* hfile;                   // source file to sort
-  HeapFileScan* hfs;                   // source file to sort
   string fileName;                      // name of source file to sort
   Datatype type;                        // type of sort attribute
   int offset;                           // offset of sort attribute
   int length;                           // length of sort attribute
+  SortOrder order;                      // direction of the sort
+  const BloomFilter* filter;            // keys of records to sort
+  BloomFilter* keys;                    // where to enter the source keys
 
-  SORTREC* buffer;                      // in-memory sort buffer
   int maxItems;                         // max. # of items/tuples in buffer
-  int numItems;                         // current # of items in buffer
+  RunGeneration runGen;                 // how the runs are generated
 };
 
 #endif